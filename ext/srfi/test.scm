@@ -217,6 +217,9 @@
 ; string-join : Gauche builtin.
 (test* "substring/shared" "cde" (substring/shared "abcde" 2))
 (test* "substring/shared" "cd"  (substring/shared "abcde" 2 4))
+(test* "substring/shared" "xyz"
+       (substring/shared (string-append (make-string 10000 #\a) "xyz")
+                         10000))
 (test* "string-copy!" "abCDEfg"
        (rlet1 x (string-copy "abcdefg")
          (string-copy! x 2 "CDE")))
@@ -593,6 +596,13 @@
 (test* "string-tokenize" '("elp" "make" "programs" "run" "run")
        (string-tokenize "Help make programs run, run, RUN!"
                         #[a-z]))
+(test* "string-tokenize" '("make" "prog")
+       (string-tokenize "Help make programs run, run, RUN!"
+                        #[a-z] 4 15))
+(test* "string-tokenize" '()
+       (string-tokenize "   "))
+(test* "string-tokenize" '("abc")
+       (string-tokenize "abc"))
 
 (test* "string-filter" "rrrr"
        (string-filter #\r "Help make programs run, run, RUN!"))
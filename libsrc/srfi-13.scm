@@ -93,6 +93,7 @@
 (define (%char-pred/pred c/s/p x) (c/s/p x))
 
 (define %maybe-substring (with-module gauche.internal %maybe-substring))
+(define %substring/shared (with-module gauche.internal %substring/shared))
 (define %hash-string (with-module gauche.internal %hash-string))
 (define %string-replace-body! (with-module gauche.internal %string-replace-body!))
 ;;;
@@ -138,7 +139,9 @@
 ;;; Selectors
 ;;;
 
-(define substring/shared string-copy)  ; same in Gauche
+;; Unlike substring, the result always shares the content of s.
+(define (substring/shared s start :optional (end -1))
+  (%substring/shared s start end))
 
 (define (string-copy! target tstart s . args)
   (check-arg string? target)
@@ -789,25 +792,24 @@
 
 (define (string-tokenize s :optional (token-set #[\S]) start end)
   (check-arg string? s)
-  (letrec ((src (open-input-string (%maybe-substring s start end)))
-           (in-word (lambda (ch dst r)
-                      (cond ((eof-object? ch)
-                             (reverse! (cons (get-output-string dst) r)))
-                            ((char-set-contains? token-set ch)
-                             (write-char ch dst)
-                             (in-word (read-char src) dst r))
-                            (else
-                             (out-word (read-char src)
-                                       (cons (get-output-string dst) r))))))
-           (out-word (lambda (ch r)
-                       (cond ((eof-object? ch) (reverse! r))
-                             ((char-set-contains? token-set ch)
-                              (let ((dst (open-output-string)))
-                                (write-char ch dst)
-                                (in-word (read-char src) dst r)))
-                             (else
-                              (out-word (read-char src) r))))))
-    (out-word (read-char src) '())))
+  ;; Each token is cut out by string-pointer-substring, so it shares
+  ;; the content of s instead of being copied.
+  (define (out-word p r)
+    (let1 ch (string-pointer-ref p)
+      (cond [(eof-object? ch) (reverse! r)]
+            [(char-set-contains? token-set ch)
+             (in-word (make-string-pointer
+                       (string-pointer-substring p :after #t))
+                      r)]
+            [else (string-pointer-next! p) (out-word p r)])))
+  (define (in-word p r)
+    (let1 ch (string-pointer-ref p)
+      (cond [(eof-object? ch)
+             (reverse! (cons (string-pointer-substring p) r))]
+            [(char-set-contains? token-set ch)
+             (string-pointer-next! p) (in-word p r)]
+            [else (out-word p (cons (string-pointer-substring p) r))])))
+  (out-word (make-string-pointer (%maybe-substring s start end)) '()))
 
 ;;;
 ;;; Filter
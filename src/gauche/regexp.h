@@ -54,6 +54,9 @@ struct ScmRegexpRec {
                             match at the beginning of the regexp.  It can be
                             used to skip input start position when regexp
                             isn't BOL_ANCHORED. */
+    struct ScmRegNfaRec *nfa; /* internal; NFA translated from code for
+                                 the linear-time matcher, or NULL if the
+                                 regexp needs the backtracking matcher. */
 };
 
 struct ScmRegMatchRec {
@@ -222,6 +222,10 @@ SCM_EXTERN ScmObj  Scm_Substring(ScmString *x,
                                  ScmSmallInt start,
                                  ScmSmallInt end,
                                  int byterange);
+SCM_EXTERN ScmObj  Scm_SubstringShared(ScmString *x,
+                                       ScmSmallInt start,
+                                       ScmSmallInt end,
+                                       int byterange);
 SCM_EXTERN ScmObj  Scm_StringReplaceBody(ScmString *x, const ScmStringBody *b);
 
 /*
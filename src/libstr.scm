@@ -117,6 +117,11 @@
 (define-cproc %maybe-substring (str::<string> :optional start end)
   Scm_MaybeSubstring)
 
+;; for srfi-13 substring/shared
+(define-cproc %substring/shared (str::<string> start::<fixnum>
+                                 :optional (end::<fixnum> -1))
+  (return (Scm_SubstringShared str start end FALSE)))
+
 ;; bound argument is for srfi-13
 (define-cproc %hash-string (str::<string> :optional bound) ::<ulong>
   (let* ([modulo::u_long 0])
@@ -237,6 +237,7 @@ static ScmRegexp *make_regexp(void)
     rx->flags = 0;
     rx->pattern = SCM_FALSE;
     rx->ast = SCM_FALSE;
+    rx->nfa = NULL;
     return rx;
 }
 
@@ -1184,6 +1185,7 @@ ScmObj Scm_RegOptimizeAST(ScmObj ast)
  */
 
 static void rc3_rec(regcomp_ctx *ctx, ScmObj ast, int lastp);
+static void rx_build_nfa(ScmRegexp *rx);
 
 /* Util function for pass3, to get an index of the charset vector
  * for the given charset.
@@ -1865,6 +1867,9 @@ static ScmObj rc3(regcomp_ctx *ctx, ScmObj ast)
     ctx->rx->code = ctx->code;
     ctx->rx->numCodes = ctx->codep;
 
+    /* pass 3-3 : translate to NFA if possible */
+    rx_build_nfa(ctx->rx);
+
     ctx->rx->ast = ast;
     return SCM_OBJ(ctx->rx);
 }
@@ -2748,6 +2753,681 @@ static inline const char *skip_input(const char *start, const char *limit,
     return limit;
 }
 
+/*=======================================================================
+ * Linear-time matcher
+ */
+
+/* The backtracking matcher above may take exponential time, or overrun
+ * the C stack, with patterns like #/(a*)*b/ or #/(a|b)*c/ on a long input.
+ * If the regexp doesn't use backreferences, conditional patterns,
+ * standalone patterns or lookaround assertions, leftmost-first semantics
+ * doesn't need backtracking; we translate the bytecode into a flat NFA
+ * and run all the alternatives in lock step (so-called Pike VM).
+ * Threads are kept in priority order, so we get exactly the same match,
+ * including submatches, as rex_rec would find.
+ *
+ * Before running the Pike VM, we run a lazily constructed DFA over the
+ * input just to see if there's any match.  DFA states are created on
+ * demand and cached in the regexp, so that repeated matching with the
+ * same regexp mostly becomes table lookups.  Reading the cache doesn't
+ * require a lock; creating a state does.
+ */
+
+enum {
+    NFA_CHAR,                   /* arg: char */
+    NFA_CHAR_CI,                /* arg: downcased char */
+    NFA_CHAR1_CI,               /* arg: downcased single-byte char */
+    NFA_ANY,
+    NFA_SET,                    /* cs */
+    NFA_NSET,
+    NFA_SET1,
+    NFA_NSET1,
+    NFA_SETR,                   /* cs; consumes the input as far as it
+                                   matches, without backtracking */
+    NFA_NSETR,
+    NFA_SET1R,
+    NFA_NSET1R,
+    NFA_SPLIT,                  /* try x first, then y */
+    NFA_JUMP,                   /* go to x */
+    NFA_SAVE,                   /* arg: capture slot (grpno*2 + 0/1) */
+    NFA_BOL,
+    NFA_EOL,
+    NFA_WB,
+    NFA_NWB,
+    NFA_FAIL,
+    NFA_MATCH
+};
+
+typedef struct nfa_node_rec {
+    int op;
+    int x;                      /* next node */
+    int y;                      /* alternative node for NFA_SPLIT */
+    ScmChar arg;
+    ScmCharSet *cs;
+} nfa_node;
+
+/* DFA state.  KERNEL is a sorted set of NFA nodes we're in right after
+   consuming a character, before following epsilon transitions; the
+   closure is computed when we know the next character, for assertions
+   and possessive repeats depend on it. */
+#define NFA_DS_ATSTART   1      /* at the beginning of input */
+#define NFA_DS_PREVWORD  2      /* the previous char is word-constituent */
+
+typedef struct nfa_dstate_rec nfa_dstate;
+
+typedef struct nfa_dwide_rec {
+    ScmChar ch;
+    nfa_dstate *to;
+} nfa_dwide;
+
+struct nfa_dstate_rec {
+    int flags;
+    int nkernel;
+    int *kernel;
+    u_long hash;
+    nfa_dstate *chain;          /* hash chain */
+    nfa_dstate *next[128];      /* transitions by ASCII chars */
+    nfa_dwide *wide;            /* last transition by non-ASCII char */
+    int eoi;                    /* match at end of input?  -1 if unknown */
+};
+
+#define NFA_DFA_BUCKETS     256
+#define NFA_DFA_MAX_STATES  1024 /* flush the cache if it grows more */
+#define NFA_DFA_MAX_FLUSHES 8    /* give up DFA if flushed this many times */
+
+typedef struct nfa_dfa_rec {
+    nfa_dstate *buckets[NFA_DFA_BUCKETS];
+    int nstates;
+    nfa_dstate *start;
+} nfa_dfa;
+
+/* Sentinel states */
+static nfa_dstate nfa_dfa_matched;
+static nfa_dstate nfa_dfa_dead;
+#define DFA_MATCHED (&nfa_dfa_matched)
+#define DFA_DEAD    (&nfa_dfa_dead)
+
+typedef struct ScmRegNfaRec {
+    int nnodes;
+    int nslots;                 /* numGroups*2 */
+    int anchored;               /* TRUE if BOL_ANCHORED */
+    nfa_node *nodes;            /* node 0 is the start node */
+    nfa_dfa *dfa;               /* DFA cache.  NULL if DFA is disabled. */
+    int nflushes;
+    ScmInternalMutex mutex;     /* protects DFA construction */
+    /* scratch area for DFA construction; protected by mutex */
+    unsigned int gen;
+    unsigned int *mark;
+    int *stack;
+    int *set;
+    int *kernel;
+} ScmRegNfa;
+
+static inline int word_char_p(ScmChar ch)
+{
+    return (ch >= 128 || is_word_constituent((unsigned char)ch));
+}
+
+/* Evaluates an assertion node.  CH is the next char, or -1 at the end. */
+static inline int nfa_assert(int op, int atstart, int prevword, ScmChar ch)
+{
+    switch (op) {
+    case NFA_BOL: return atstart;
+    case NFA_EOL: return (ch < 0);
+    case NFA_WB:
+        return (atstart || ch < 0 || prevword != word_char_p(ch));
+    case NFA_NWB:
+        return !(atstart || ch < 0 || prevword != word_char_p(ch));
+    }
+    return FALSE;
+}
+
+static inline int nfa_accept(const nfa_node *n, ScmChar ch)
+{
+    switch (n->op) {
+    case NFA_CHAR:     return (ch == n->arg);
+    case NFA_CHAR_CI:  return (Scm_CharDowncase(ch) == n->arg);
+    case NFA_CHAR1_CI: return (ch < 128 && Scm_CharDowncase(ch) == n->arg);
+    case NFA_ANY:      return TRUE;
+    case NFA_SET:
+    case NFA_SETR:     return Scm_CharSetContains(n->cs, ch);
+    case NFA_NSET:
+    case NFA_NSETR:    return !Scm_CharSetContains(n->cs, ch);
+    case NFA_SET1:
+    case NFA_SET1R:    return (ch < 128 && Scm_CharSetContains(n->cs, ch));
+    case NFA_NSET1:
+    case NFA_NSET1R:   return (ch >= 128 || !Scm_CharSetContains(n->cs, ch));
+    }
+    return FALSE;
+}
+
+static inline int nfa_repeat_p(const nfa_node *n)
+{
+    return (n->op >= NFA_SETR && n->op <= NFA_NSET1R);
+}
+
+static inline int nfa_consuming_p(const nfa_node *n)
+{
+    return (n->op <= NFA_NSET1R);
+}
+
+static nfa_dfa *dfa_new(ScmRegNfa *nfa);
+
+/* Translate rx->code into NFA.  Leaves rx->nfa NULL if the code contains
+   an instruction that needs the backtracking matcher. */
+static void rx_build_nfa(ScmRegexp *rx)
+{
+    const unsigned char *code = rx->code;
+    int ncodes = rx->numCodes;
+    int *offmap = SCM_NEW_ATOMIC_ARRAY(int, ncodes+1);
+    int nnodes = 0;
+
+    /* first pass: validate and count nodes */
+    for (int pc = 0; pc < ncodes;) {
+        offmap[pc] = nnodes;
+        switch (code[pc]) {
+        case RE_MATCH1: case RE_MATCH1_CI:
+        case RE_SET: case RE_NSET: case RE_SET1: case RE_NSET1:
+        case RE_SETR: case RE_NSETR: case RE_SET1R: case RE_NSET1R:
+            nnodes++; pc += 2; break;
+        case RE_MATCH: case RE_MATCH_CI: {
+            const unsigned char *p = code + pc + 2;
+            const unsigned char *e = p + code[pc+1];
+            while (p < e) {
+                ScmChar ch;
+                SCM_CHAR_GET(p, ch);
+                p += SCM_CHAR_NBYTES(ch);
+                nnodes++;
+            }
+            pc += 2 + code[pc+1];
+            break;
+        }
+        case RE_BEGIN: case RE_END:
+            if (code[pc+1] >= rx->numGroups) return;
+            nnodes++; pc += 2; break;
+        case RE_TRY: case RE_JUMP:
+            nnodes++; pc += 3; break;
+        case RE_ANY: case RE_BOL: case RE_EOL: case RE_WB: case RE_NWB:
+        case RE_FAIL: case RE_SUCCESS:
+            nnodes++; pc++; break;
+        default:
+            /* backreferences, conditionals, standalone patterns and
+               lookaround assertions */
+            return;
+        }
+    }
+    offmap[ncodes] = nnodes;
+
+    /* second pass: generate nodes */
+    nfa_node *nodes = SCM_NEW_ARRAY(nfa_node, nnodes+1);
+    int k = 0;
+#define NODE(op_, arg_, cs_)                                    \
+    (nodes[k].op = (op_), nodes[k].x = k+1, nodes[k].y = -1,    \
+     nodes[k].arg = (arg_), nodes[k].cs = (cs_), k++)
+    for (int pc = 0; pc < ncodes;) {
+        int op = code[pc];
+        switch (op) {
+        case RE_MATCH1:
+            NODE(NFA_CHAR, code[pc+1], NULL); pc += 2; break;
+        case RE_MATCH1_CI:
+            NODE(NFA_CHAR1_CI, code[pc+1], NULL); pc += 2; break;
+        case RE_MATCH: case RE_MATCH_CI: {
+            const unsigned char *p = code + pc + 2;
+            const unsigned char *e = p + code[pc+1];
+            while (p < e) {
+                ScmChar ch;
+                SCM_CHAR_GET(p, ch);
+                p += SCM_CHAR_NBYTES(ch);
+                NODE((op == RE_MATCH)? NFA_CHAR : NFA_CHAR_CI, ch, NULL);
+            }
+            pc += 2 + code[pc+1];
+            break;
+        }
+        case RE_SET:   NODE(NFA_SET,   0, rx->sets[code[pc+1]]); pc += 2; break;
+        case RE_NSET:  NODE(NFA_NSET,  0, rx->sets[code[pc+1]]); pc += 2; break;
+        case RE_SET1:  NODE(NFA_SET1,  0, rx->sets[code[pc+1]]); pc += 2; break;
+        case RE_NSET1: NODE(NFA_NSET1, 0, rx->sets[code[pc+1]]); pc += 2; break;
+        case RE_SETR:  NODE(NFA_SETR,  0, rx->sets[code[pc+1]]); pc += 2; break;
+        case RE_NSETR: NODE(NFA_NSETR, 0, rx->sets[code[pc+1]]); pc += 2; break;
+        case RE_SET1R: NODE(NFA_SET1R, 0, rx->sets[code[pc+1]]); pc += 2; break;
+        case RE_NSET1R:NODE(NFA_NSET1R,0, rx->sets[code[pc+1]]); pc += 2; break;
+        case RE_BEGIN: NODE(NFA_SAVE, code[pc+1]*2, NULL); pc += 2; break;
+        case RE_END:   NODE(NFA_SAVE, code[pc+1]*2+1, NULL); pc += 2; break;
+        case RE_TRY:
+            NODE(NFA_SPLIT, 0, NULL);
+            nodes[k-1].y = offmap[code[pc+1]*256 + code[pc+2]];
+            pc += 3;
+            break;
+        case RE_JUMP:
+            NODE(NFA_JUMP, 0, NULL);
+            nodes[k-1].x = offmap[code[pc+1]*256 + code[pc+2]];
+            pc += 3;
+            break;
+        case RE_ANY:     NODE(NFA_ANY, 0, NULL); pc++; break;
+        case RE_BOL:     NODE(NFA_BOL, 0, NULL); pc++; break;
+        case RE_EOL:     NODE(NFA_EOL, 0, NULL); pc++; break;
+        case RE_WB:      NODE(NFA_WB, 0, NULL); pc++; break;
+        case RE_NWB:     NODE(NFA_NWB, 0, NULL); pc++; break;
+        case RE_FAIL:    NODE(NFA_FAIL, 0, NULL); pc++; break;
+        case RE_SUCCESS: NODE(NFA_MATCH, 0, NULL); pc++; break;
+        }
+    }
+#undef NODE
+    SCM_ASSERT(k == nnodes);
+    /* The code always ends with RE_SUCCESS, but just in case. */
+    nodes[nnodes].op = NFA_FAIL;
+    nodes[nnodes].x = nodes[nnodes].y = -1;
+    nnodes++;
+
+    ScmRegNfa *nfa = SCM_NEW(ScmRegNfa);
+    nfa->nnodes = nnodes;
+    nfa->nslots = rx->numGroups * 2;
+    nfa->anchored = (rx->flags & SCM_REGEXP_BOL_ANCHORED) != 0;
+    nfa->nodes = nodes;
+    nfa->dfa = NULL;
+    nfa->nflushes = 0;
+    SCM_INTERNAL_MUTEX_INIT(nfa->mutex);
+    nfa->gen = 0;
+    nfa->mark = SCM_NEW_ATOMIC_ARRAY(unsigned int, nnodes);
+    memset(nfa->mark, 0, sizeof(unsigned int)*nnodes);
+    nfa->stack = SCM_NEW_ATOMIC_ARRAY(int, nnodes*2+2);
+    nfa->set = SCM_NEW_ATOMIC_ARRAY(int, nnodes+1);
+    nfa->kernel = SCM_NEW_ATOMIC_ARRAY(int, nnodes+1);
+    nfa->dfa = dfa_new(nfa);
+    rx->nfa = nfa;
+}
+
+/*
+ * Lazy DFA
+ */
+
+static inline unsigned int dfa_newgen(ScmRegNfa *nfa)
+{
+    if (++nfa->gen == 0) {
+        memset(nfa->mark, 0, sizeof(unsigned int)*nfa->nnodes);
+        nfa->gen = 1;
+    }
+    return nfa->gen;
+}
+
+/* Computes the closure of KERNEL, plus the start node unless the regexp
+   is anchored, with the next char CH (-1 at the end of input).  Consuming
+   nodes are stored in nfa->set.  Returns the number of them, or -1 if
+   we reach NFA_MATCH. */
+static int dfa_closure(ScmRegNfa *nfa, const int *kernel, int nkernel,
+                       int flags, ScmChar ch)
+{
+    unsigned int gen = dfa_newgen(nfa);
+    int atstart = (flags & NFA_DS_ATSTART) != 0;
+    int prevword = (flags & NFA_DS_PREVWORD) != 0;
+    int sp = 0, nset = 0;
+
+    /* Priority doesn't matter here, so we don't care the order. */
+    if (!nfa->anchored || atstart) {
+        nfa->mark[0] = gen;
+        nfa->stack[sp++] = 0;
+    }
+    for (int i = 0; i < nkernel; i++) {
+        if (nfa->mark[kernel[i]] == gen) continue;
+        nfa->mark[kernel[i]] = gen;
+        nfa->stack[sp++] = kernel[i];
+    }
+    while (sp > 0) {
+        int pc = nfa->stack[--sp];
+        const nfa_node *n = &nfa->nodes[pc];
+        switch (n->op) {
+        case NFA_MATCH:
+            return -1;
+        case NFA_FAIL:
+            continue;
+        case NFA_SPLIT:
+            if (nfa->mark[n->y] != gen) {
+                nfa->mark[n->y] = gen; nfa->stack[sp++] = n->y;
+            }
+            /*FALLTHROUGH*/
+        case NFA_JUMP: case NFA_SAVE:
+            if (nfa->mark[n->x] != gen) {
+                nfa->mark[n->x] = gen; nfa->stack[sp++] = n->x;
+            }
+            continue;
+        case NFA_BOL: case NFA_EOL: case NFA_WB: case NFA_NWB:
+            if (nfa_assert(n->op, atstart, prevword, ch)
+                && nfa->mark[n->x] != gen) {
+                nfa->mark[n->x] = gen; nfa->stack[sp++] = n->x;
+            }
+            continue;
+        default:
+            if (nfa_repeat_p(n) && (ch < 0 || !nfa_accept(n, ch))) {
+                if (nfa->mark[n->x] != gen) {
+                    nfa->mark[n->x] = gen; nfa->stack[sp++] = n->x;
+                }
+                continue;
+            }
+            nfa->set[nset++] = pc;
+        }
+    }
+    return nset;
+}
+
+static int dfa_kernel_compare(const void *a, const void *b)
+{
+    return *(const int*)a - *(const int*)b;
+}
+
+/* Find or create a state.  Returns NULL if the cache is full. */
+static nfa_dstate *dfa_intern(nfa_dfa *dfa, const int *kernel, int nkernel,
+                              int flags)
+{
+    u_long h = (u_long)flags;
+    for (int i = 0; i < nkernel; i++) h = h*31 + (u_long)kernel[i];
+    nfa_dstate **bucket = &dfa->buckets[h % NFA_DFA_BUCKETS];
+    for (nfa_dstate *s = *bucket; s; s = s->chain) {
+        if (s->hash == h && s->flags == flags && s->nkernel == nkernel
+            && memcmp(s->kernel, kernel, sizeof(int)*nkernel) == 0) {
+            return s;
+        }
+    }
+    if (dfa->nstates >= NFA_DFA_MAX_STATES) return NULL;
+    nfa_dstate *s = SCM_NEW(nfa_dstate);
+    s->flags = flags;
+    s->nkernel = nkernel;
+    s->kernel = SCM_NEW_ATOMIC_ARRAY(int, nkernel+1);
+    memcpy(s->kernel, kernel, sizeof(int)*nkernel);
+    s->hash = h;
+    s->wide = NULL;
+    s->eoi = -1;
+    for (int i = 0; i < 128; i++) s->next[i] = NULL;
+    s->chain = *bucket;
+    *bucket = s;
+    dfa->nstates++;
+    return s;
+}
+
+static nfa_dfa *dfa_new(ScmRegNfa *nfa)
+{
+    nfa_dfa *dfa = SCM_NEW(nfa_dfa);
+    for (int i = 0; i < NFA_DFA_BUCKETS; i++) dfa->buckets[i] = NULL;
+    dfa->nstates = 0;
+    dfa->start = dfa_intern(dfa, NULL, 0, NFA_DS_ATSTART);
+    return dfa;
+}
+
+/* Computes the transition from S by CH and records it.  Called with
+   nfa->mutex held.  Returns NULL if the cache overflows. */
+static nfa_dstate *dfa_compute(ScmRegNfa *nfa, nfa_dfa *dfa,
+                               nfa_dstate *s, ScmChar ch)
+{
+    int nset = dfa_closure(nfa, s->kernel, s->nkernel, s->flags, ch);
+    if (nset < 0) return DFA_MATCHED;
+
+    unsigned int gen = dfa_newgen(nfa);
+    int nkernel = 0;
+    for (int i = 0; i < nset; i++) {
+        const nfa_node *n = &nfa->nodes[nfa->set[i]];
+        if (!nfa_accept(n, ch)) continue;
+        int to = nfa_repeat_p(n)? nfa->set[i] : n->x;
+        if (nfa->mark[to] == gen) continue;
+        nfa->mark[to] = gen;
+        nfa->kernel[nkernel++] = to;
+    }
+    if (nkernel == 0 && nfa->anchored) return DFA_DEAD;
+    qsort(nfa->kernel, nkernel, sizeof(int), dfa_kernel_compare);
+    return dfa_intern(dfa, nfa->kernel, nkernel,
+                      word_char_p(ch)? NFA_DS_PREVWORD : 0);
+}
+
+/* Slow path of dfa_run.  Returns NULL if we should give up DFA. */
+static nfa_dstate *dfa_miss(ScmRegNfa *nfa, nfa_dfa *dfa,
+                            nfa_dstate *s, ScmChar ch)
+{
+    nfa_dstate *t = NULL;
+    SCM_INTERNAL_MUTEX_LOCK(nfa->mutex);
+    if (ch < 0) {
+        if (s->eoi < 0) {
+            s->eoi = (dfa_closure(nfa, s->kernel, s->nkernel,
+                                  s->flags, -1) < 0);
+        }
+        t = s->eoi? DFA_MATCHED : DFA_DEAD;
+    } else if (ch < 128 && s->next[ch]) {
+        t = s->next[ch];        /* another thread has computed it */
+    } else {
+        t = dfa_compute(nfa, dfa, s, ch);
+        if (t == NULL) {
+            /* Cache is full.  Start over with a fresh cache; the states
+               other threads are walking on are left to GC. */
+            if (nfa->dfa == dfa) {
+                nfa->dfa = (++nfa->nflushes < NFA_DFA_MAX_FLUSHES)
+                    ? dfa_new(nfa) : NULL;
+            }
+        } else if (ch < 128) {
+            SCM_INTERNAL_SYNC();
+            s->next[ch] = t;
+        } else {
+            nfa_dwide *w = SCM_NEW(nfa_dwide);
+            w->ch = ch;
+            w->to = t;
+            SCM_INTERNAL_SYNC();
+            s->wide = w;
+        }
+    }
+    SCM_INTERNAL_MUTEX_UNLOCK(nfa->mutex);
+    return t;
+}
+
+/* Returns 1 if RX matches somewhere in [input, stop), 0 if not, or -1
+   if we gave up. */
+static int dfa_run(ScmRegNfa *nfa, const char *input, const char *stop)
+{
+    nfa_dfa *dfa = nfa->dfa;
+    if (dfa == NULL) return -1;
+    nfa_dstate *s = dfa->start, *t;
+
+    for (const char *p = input; p < stop;) {
+        ScmChar ch = (unsigned char)*p;
+        if (ch < 128) {
+            t = s->next[ch];
+            p++;
+        } else {
+            SCM_CHAR_GET(p, ch);
+            p += SCM_CHAR_NBYTES(ch);
+            nfa_dwide *w = s->wide;
+            t = (w && w->ch == ch)? w->to : NULL;
+        }
+        if (t == NULL) {
+            t = dfa_miss(nfa, dfa, s, ch);
+            if (t == NULL) return -1;
+        }
+        if (t == DFA_MATCHED) return 1;
+        if (t == DFA_DEAD) return 0;
+        s = t;
+    }
+    if (s->eoi < 0) {
+        if (dfa_miss(nfa, dfa, s, -1) == DFA_MATCHED) return 1;
+        return 0;
+    }
+    return s->eoi;
+}
+
+/*
+ * Pike VM
+ */
+
+typedef struct pike_list_rec {
+    int n;
+    int *pcs;
+    const char **caps;          /* nslots entries per thread */
+} pike_list;
+
+typedef struct pike_ctx_rec {
+    ScmRegNfa *nfa;
+    unsigned int *mark;
+    unsigned int gen;
+    struct pike_stack {
+        int pc;                 /* -1 to restore the slot */
+        int slot;
+        const char *saved;
+    } *stack;
+    const char **work;          /* captures of the thread being followed */
+    const char *input;          /* beginning of input */
+} pike_ctx;
+
+/* Adds a thread at PC, following epsilon transitions in priority order.
+   ctx->work holds the captures of the thread; it's restored on return.
+   POS is the current position, CH is the char at POS (-1 at the end). */
+static void pike_add(pike_ctx *ctx, pike_list *list, int pc,
+                     const char *pos, int prevword, ScmChar ch)
+{
+    ScmRegNfa *nfa = ctx->nfa;
+    int nslots = nfa->nslots, sp = 0;
+    int atstart = (pos == ctx->input);
+
+    ctx->stack[sp++].pc = pc;
+    while (sp > 0) {
+        struct pike_stack *e = &ctx->stack[--sp];
+        if (e->pc < 0) {
+            ctx->work[e->slot] = e->saved;
+            continue;
+        }
+        pc = e->pc;
+        if (ctx->mark[pc] == ctx->gen) continue;
+        ctx->mark[pc] = ctx->gen;
+        const nfa_node *n = &nfa->nodes[pc];
+        switch (n->op) {
+        case NFA_FAIL:
+            continue;
+        case NFA_SPLIT:
+            ctx->stack[sp++].pc = n->y;
+            ctx->stack[sp++].pc = n->x;
+            continue;
+        case NFA_JUMP:
+            ctx->stack[sp++].pc = n->x;
+            continue;
+        case NFA_SAVE:
+            ctx->stack[sp].pc = -1;
+            ctx->stack[sp].slot = (int)n->arg;
+            ctx->stack[sp].saved = ctx->work[n->arg];
+            sp++;
+            ctx->work[n->arg] = pos;
+            ctx->stack[sp++].pc = n->x;
+            continue;
+        case NFA_BOL: case NFA_EOL: case NFA_WB: case NFA_NWB:
+            if (nfa_assert(n->op, atstart, prevword, ch)) {
+                ctx->stack[sp++].pc = n->x;
+            }
+            continue;
+        default:
+            if (nfa_repeat_p(n) && (ch < 0 || !nfa_accept(n, ch))) {
+                ctx->stack[sp++].pc = n->x;
+                continue;
+            }
+            /* consuming node or NFA_MATCH */
+            list->pcs[list->n] = pc;
+            memcpy(list->caps + list->n*nslots, ctx->work,
+                   sizeof(const char*)*nslots);
+            list->n++;
+        }
+    }
+}
+
+static ScmObj pike_exec(ScmRegexp *rx, ScmString *orig,
+                        const char *input, const char *stop)
+{
+    ScmRegNfa *nfa = rx->nfa;
+    int nnodes = nfa->nnodes, nslots = nfa->nslots;
+    pike_ctx ctx;
+    pike_list lists[2], *clist = &lists[0], *nlist = &lists[1];
+    const char **matched = NULL;
+
+    ctx.nfa = nfa;
+    ctx.input = input;
+    ctx.mark = SCM_NEW_ATOMIC_ARRAY(unsigned int, nnodes);
+    memset(ctx.mark, 0, sizeof(unsigned int)*nnodes);
+    ctx.gen = 1;
+    /* each node pushes at most two entries */
+    ctx.stack = SCM_NEW_ATOMIC_ARRAY(struct pike_stack, nnodes*2+2);
+    /* NB: Captures point into the input string, which is kept alive by
+       the caller; so we can use atomic allocation. */
+    ctx.work = SCM_NEW_ATOMIC_ARRAY(const char*, nslots+1);
+    for (int i = 0; i < 2; i++) {
+        lists[i].n = 0;
+        lists[i].pcs = SCM_NEW_ATOMIC_ARRAY(int, nnodes);
+        lists[i].caps = SCM_NEW_ATOMIC_ARRAY(const char*, nnodes*nslots+1);
+    }
+
+    const char *pos = input;
+    int prevword = FALSE;
+    ScmChar ch = -1;
+    if (pos < stop) SCM_CHAR_GET(pos, ch);
+
+    for (int i = 0; i < nslots; i++) ctx.work[i] = NULL;
+    pike_add(&ctx, clist, 0, pos, prevword, ch);
+
+    for (;;) {
+        const char *npos = NULL;
+        ScmChar nch = -1;
+        int nprevword = FALSE;
+        if (ch >= 0) {
+            npos = pos + SCM_CHAR_NBYTES(ch);
+            if (npos < stop) SCM_CHAR_GET(npos, nch);
+            nprevword = word_char_p(ch);
+        }
+        ctx.gen++;
+        nlist->n = 0;
+        for (int i = 0; i < clist->n; i++) {
+            const nfa_node *n = &nfa->nodes[clist->pcs[i]];
+            const char **caps = clist->caps + i*nslots;
+            if (n->op == NFA_MATCH) {
+                /* Lower priority threads are cut off. */
+                if (matched == NULL) {
+                    matched = SCM_NEW_ATOMIC_ARRAY(const char*, nslots+1);
+                }
+                memcpy(matched, caps, sizeof(const char*)*nslots);
+                break;
+            }
+            if (ch < 0 || !nfa_accept(n, ch)) continue;
+            memcpy(ctx.work, caps, sizeof(const char*)*nslots);
+            pike_add(&ctx, nlist,
+                     nfa_repeat_p(n)? clist->pcs[i] : n->x,
+                     npos, nprevword, nch);
+        }
+        if (ch < 0) break;
+        if (matched == NULL && !nfa->anchored) {
+            /* Try a match beginning from the next position, with
+               the lowest priority. */
+            for (int i = 0; i < nslots; i++) ctx.work[i] = NULL;
+            pike_add(&ctx, nlist, 0, npos, nprevword, nch);
+        } else if (nlist->n == 0) {
+            break;
+        }
+        pike_list *tmp = clist; clist = nlist; nlist = tmp;
+        pos = npos;
+        ch = nch;
+        prevword = nprevword;
+    }
+
+    if (matched == NULL) return SCM_FALSE;
+
+    struct match_ctx mctx;
+    mctx.matches = SCM_NEW_ARRAY(struct ScmRegMatchSub *, rx->numGroups);
+    for (int i = 0; i < rx->numGroups; i++) {
+        mctx.matches[i] = SCM_NEW(struct ScmRegMatchSub);
+        mctx.matches[i]->start = -1;
+        mctx.matches[i]->length = -1;
+        mctx.matches[i]->after = -1;
+        mctx.matches[i]->startp = matched[i*2];
+        mctx.matches[i]->endp = matched[i*2+1];
+    }
+    return make_match(rx, orig, &mctx);
+}
+
+/* Linear-time matching.  Returns a regmatch, or #f. */
+static ScmObj rex_linear(ScmRegexp *rx, ScmString *orig,
+                         const char *start, const char *end)
+{
+    if (dfa_run(rx->nfa, start, end) == 0) return SCM_FALSE;
+    return pike_exec(rx, orig, start, end);
+}
+
 /*----------------------------------------------------------------------
  * entry point
  */
@@ -2777,6 +3457,11 @@ ScmObj Scm_RegExec(ScmRegexp *rx, ScmString *str)
         }
     }
 #endif
+    /* if the regexp doesn't need backtracking, use linear-time matcher. */
+    if (rx->nfa) {
+        return rex_linear(rx, str, start, end);
+    }
+
     /* short cut : if rx matches only at the beginning of the string,
        we only run from the beginning of the string */
     if (rx->flags & SCM_REGEXP_BOL_ANCHORED) {
@@ -786,23 +786,37 @@ ScmObj Scm_StringReplaceBody(ScmString *str, const ScmStringBody *newbody)
  * Substring
  */
 
+/* A substring shares the content of the original string; we never
+   alter the content of a string body, so it is safe.   The downside is
+   that a tiny substring keeps the whole content of a huge original string
+   from being collected.  Unless the caller explicitly asks sharing,
+   we copy the content if the substring is much smaller than the original.
+   The copy is small by definition, so it is cheap. */
+#define SLICE_COPY_MIN_PARENT_SIZE  4096
+#define SLICE_COPY_RATIO            16
+
+static inline int slice_should_copy(ScmSmallInt parent_size,
+                                    ScmSmallInt size)
+{
+    return (parent_size >= SLICE_COPY_MIN_PARENT_SIZE
+            && size < parent_size/SLICE_COPY_RATIO);
+}
+
 static ScmObj substring(const ScmStringBody *xb,
                         ScmSmallInt start, ScmSmallInt end,
-                        int byterange)
+                        int byterange, int shared)
 {
     ScmSmallInt len = byterange? SCM_STRING_BODY_SIZE(xb) : SCM_STRING_BODY_LENGTH(xb);
     int flags = SCM_STRING_BODY_FLAGS(xb) & ~SCM_STRING_IMMUTABLE;
+    const char *s, *e;
     SCM_CHECK_START_END(start, end, len);
 
     if (SCM_STRING_BODY_SINGLE_BYTE_P(xb) || byterange) {
         if (end != len) flags &= ~SCM_STRING_TERMINATED;
         if (byterange)  flags |= SCM_STRING_INCOMPLETE;
-        return SCM_OBJ(make_str(end-start,
-                                end-start,
-                                SCM_STRING_BODY_START(xb) + start,
-                                flags));
+        s = SCM_STRING_BODY_START(xb) + start;
+        e = SCM_STRING_BODY_START(xb) + end;
     } else {
-        const char *s, *e;
         if (start) s = forward_pos(SCM_STRING_BODY_START(xb), start);
         else s = SCM_STRING_BODY_START(xb);
         if (len == end) {
@@ -811,19 +825,38 @@ static ScmObj substring(const ScmStringBody *xb,
             e = forward_pos(s, end - start);
             flags &= ~SCM_STRING_TERMINATED;
         }
-        return SCM_OBJ(make_str((int)(end - start), (int)(e - s), s, flags));
     }
+
+    ScmSmallInt size = e - s;
+    if (!shared && slice_should_copy(SCM_STRING_BODY_SIZE(xb), size)) {
+        /* SCM_STRDUP_PARTIAL terminates the result */
+        flags |= SCM_STRING_TERMINATED;
+        s = SCM_STRDUP_PARTIAL(s, size);
+    }
+    return SCM_OBJ(make_str(end - start, size, s, flags));
 }
 
 ScmObj Scm_Substring(ScmString *x, ScmSmallInt start, ScmSmallInt end,
                      int byterangep)
 {
-    return substring(SCM_STRING_BODY(x), start, end, byterangep);
+    return substring(SCM_STRING_BODY(x), start, end, byterangep, FALSE);
+}
+
+/* Like Scm_Substring, but the result always shares the content with X,
+   no matter how small it is.  Useful when the caller knows the original
+   string won't outlive the substrings much, e.g. splitting a string
+   into fields. */
+ScmObj Scm_SubstringShared(ScmString *x, ScmSmallInt start, ScmSmallInt end,
+                           int byterangep)
+{
+    return substring(SCM_STRING_BODY(x), start, end, byterangep, TRUE);
 }
 
 /* Auxiliary procedure to support optional start/end parameter specified
    in lots of SRFI-13 functions.   If start and end is specified and restricts
-   string range, call substring.  Otherwise returns x itself. */
+   string range, call substring.  Otherwise returns x itself.
+   The result always shares the content with x, since it is mostly
+   used as a temporary view of the range of x. */
 ScmObj Scm_MaybeSubstring(ScmString *x, ScmObj start, ScmObj end)
 {
     ScmSmallInt istart, iend;
@@ -844,7 +877,7 @@ ScmObj Scm_MaybeSubstring(ScmString *x, ScmObj start, ScmObj end)
             Scm_Error("exact integer required for start, but got %S", end);
         iend = SCM_INT_VALUE(end);
     }
-    return substring(xb, istart, iend, FALSE);
+    return substring(xb, istart, iend, FALSE, TRUE);
 }
 
 /*----------------------------------------------------------------
@@ -1181,19 +1214,14 @@ ScmObj Scm_StringScanCharRight(ScmString *s1, ScmChar ch, int retmode)
     else return Scm_Values2(v1, v2);
 }
 
-#undef NOT_FOUND
-#undef FOUND_BOTH_INDEX
-#undef FOUND_BYTE_INDEX
-#undef FOUND_MAYBE_BOTH
-#undef BYTEWISE_SEARCHABLE
-#undef MULTIBYTE_NAIVE_SEARCH_NEEDED
-
 /* Split string by char.  Char itself is not included in the result.
    If LIMIT >= 0, up to that number of matches are considered (i.e.
    up to LIMIT+1 strings are returned).   LIMIT < 0 makes the number
    of matches unlimited.
+   Each resulting string shares the content of STR; we neither copy
+   the fields nor allocate the intermediate 'rest' strings.
    TODO: If CH is a utf-8 multi-byte char, Boyer-Moore skip table is
-   calculated every time we call string_scan, which is a waste.  Some
+   calculated every time we call string_search, which is a waste.  Some
    mechanism to cache the skip table would be nice.
 */
 ScmObj Scm_StringSplitByCharWithLimit(ScmString *str, ScmChar ch, int limit)
@@ -1206,22 +1234,55 @@ ScmObj Scm_StringSplitByCharWithLimit(ScmString *str, ScmChar ch, int limit)
 
     SCM_CHAR_PUT(buf, ch);
 
+    const ScmStringBody *b = SCM_STRING_BODY(str);
+    const char *s = SCM_STRING_BODY_START(b);
+    ScmSmallInt siz = SCM_STRING_BODY_SIZE(b);
+    ScmSmallInt len = SCM_STRING_BODY_LENGTH(b);
+    int incomplete = SCM_STRING_BODY_INCOMPLETE_P(b);
+    int flags = incomplete? SCM_STRING_INCOMPLETE : 0;
+
+    /* if str is complete sbstring and ch is mbchar, we know there's
+       no match. */
+    if (!incomplete && siz == len && nb > 1) {
+        return SCM_LIST1(SCM_OBJ(str));
+    }
+
     for (;;) {
-        ScmObj v1, v2;
-        v1 = string_scan(str, buf, nb, 1, FALSE, SCM_STRING_SCAN_BOTH,
-                         string_search, &v2);
-        if (SCM_FALSEP(v1)) {
-            SCM_APPEND1(head, tail, SCM_OBJ(str));
+        ScmSmallInt bi, ci;
+        int r = string_search(s, siz, len, buf, nb, 1, &bi, &ci);
+        if (r == NOT_FOUND) {
+            if (s == SCM_STRING_BODY_START(b)) {
+                SCM_APPEND1(head, tail, SCM_OBJ(str));
+            } else {
+                int rflags = flags
+                    | (SCM_STRING_BODY_FLAGS(b) & SCM_STRING_TERMINATED);
+                SCM_APPEND1(head, tail, SCM_OBJ(make_str(len, siz, s, rflags)));
+            }
+            break;
+        }
+        if (incomplete) ci = bi;
+        else if (r == FOUND_BYTE_INDEX) ci = count_length(s, bi);
+        SCM_APPEND1(head, tail, SCM_OBJ(make_str(ci, bi, s, flags)));
+        s += bi + nb;
+        siz -= bi + nb;
+        len = incomplete? siz : len - ci - 1;
+        if (--limit == 0) {
+            int rflags = flags
+                | (SCM_STRING_BODY_FLAGS(b) & SCM_STRING_TERMINATED);
+            SCM_APPEND1(head, tail, SCM_OBJ(make_str(len, siz, s, rflags)));
             break;
-        } else {
-            SCM_APPEND1(head, tail, v1);
-            if (--limit == 0) { SCM_APPEND1(head, tail, v2); break; }
         }
-        str = SCM_STRING(v2);
     }
     return head;
 }
 
+#undef NOT_FOUND
+#undef FOUND_BOTH_INDEX
+#undef FOUND_BYTE_INDEX
+#undef FOUND_MAYBE_BOTH
+#undef BYTEWISE_SEARCHABLE
+#undef MULTIBYTE_NAIVE_SEARCH_NEEDED
+
 /* For ABI compatibility - On 1.0, let's make this have limit arg and
    drop Scm_StringSplitByCharWithLimit.  */
 ScmObj Scm_StringSplitByChar(ScmString *str, ScmChar ch)
@@ -39,6 +39,17 @@
 (test* "string-copy" "cde" (string-copy "abcde" 2))
 (test* "string-copy" "cd"  (string-copy "abcde" 2 4))
 
+(test* "substring" "cd" (substring "abcde" 2 4))
+(let1 s (string-append (make-string 10000 #\a) "xyz" (make-string 10000 #\b))
+  ;; a small substring of a large string is copied internally;
+  ;; it shouldn't be visible.
+  (test* "substring (small part of large string)" '("axyzb" 5)
+         (let1 t (substring s 9999 10004)
+           (list t (string-length t))))
+  (test* "substring (large part of large string)" '(10003 #\z)
+         (let1 t (substring s 0 10003)
+           (list (string-length t) (string-ref t 10002)))))
+
 (test* "string-ref" #\b (string-ref "abc" 1))
 (define x (string-copy "abcde"))
 (test* "string-set!" "abZde" (begin (string-set! x 2 #\Z) x))
@@ -186,6 +197,10 @@
        (string-split "" #\*))
 (test* "string-split (char)" '("" "")
        (string-split "*" #\*))
+(test* "string-split (char)" '("aa" "bbb" "c")
+       (string-split (string-copy "aa*bbb*c") #\*))
+(test* "string-split (char, incomplete)" '(#*"aa" #*"bbb" #*"c")
+       (string-split #*"aa*bbb*c" #\*))
 
 (test* "string-split (1-char string)" '("aa" "bbb" "c")
        (string-split "aa*bbb*c" "*"))
@@ -89,6 +89,15 @@
   (test-string-scan #f "あえいうえおあおあいうえお" "おい")
   )
 
+(test* "string-split (mbchar)" '("あい" "うえお" "" "か")
+       (string-split "あい、うえお、、か" #\、))
+(test* "string-split (mbchar)" '("abc")
+       (string-split "abc" #\、))
+(test* "string-split (mbchar, limit)" '("あい" "うえお、、か")
+       (string-split "あい、うえお、、か" #\、 1))
+(test* "string-split (char)" '("あい" "うえお" "か")
+       (string-split "あい,うえお,か" #\,))
+
 ;;-------------------------------------------------------------------
 (test-section "string-pointer")
 (define sp #f)
@@ -237,6 +246,9 @@
 (test "string-pad" "パディング" (lambda () (string-pad "パディング" 5 #\■)))
 (test "string-pad" "ディングス" (lambda () (string-pad "パディングス" 5 #\■)))
 (test "string-pad-right" "パッド■■" (lambda () (string-pad-right "パッド" 5 #\■)))
+(test* "string-tokenize" '("いろは" "にほへと")
+       (string-tokenize "  いろは にほへと "))
+(test* "substring/shared" "へと" (substring/shared "いろはにほへと" 5))
 (test "string-pad" "パディング" (lambda () (string-pad-right "パディングス" 5 #\■)))
 
 ;;-------------------------------------------------------------------